@@ -1,6 +1,6 @@
 @echo off
 REM Build and upload script for RX Servant ESP32
-REM Usage: build_rx.bat [1|2|3|4|debug]
+REM Usage: build_rx.bat [1|2|3|4|debug|lowpower 1-4]
 
 echo ========================================
 echo  RX Passive Thermal GCT Build Script
@@ -131,15 +131,46 @@ if "%1"=="1" (
         echo Build FAILED! Error code: %ERRORLEVEL%
         goto show_help
     )
+) else if "%1"=="lowpower" (
+    if "%2"=="" (
+        echo Missing GCT device ID: build_rx.bat lowpower [1^|2^|3^|4]
+        goto end
+    )
+    echo Building LOW POWER version for GCT Device %2...
+    pio run -e rx-gct%2-lowpower
+    if %ERRORLEVEL% EQU 0 (
+        echo.
+        echo Build successful! Upload now? [Y/N]
+        set /p confirm=
+        if /i "%confirm%"=="Y" (
+            echo.
+            echo Uploading to ESP32...
+            pio run -e rx-gct%2-lowpower --target upload
+            echo Upload command completed with exit code: %ERRORLEVEL%
+            if %ERRORLEVEL% EQU 0 (
+                echo Upload successful!
+            ) else (
+                echo Upload FAILED! Check ESP32 connection and COM port.
+            )
+        ) else (
+            echo Upload skipped.
+        )
+    ) else (
+        echo.
+        echo Build FAILED! Error code: %ERRORLEVEL%
+        goto show_help
+    )
 ) else (
-    echo Usage: build_rx.bat [1^|2^|3^|4^|debug]
+    echo Usage: build_rx.bat [1^|2^|3^|4^|debug^|lowpower 1-4]
     echo.
     echo   1-4    : Build for specific GCT device ID
     echo   debug  : Build debug version
+    echo   lowpower N : Build low power version for GCT device N (deep sleep between samples)
     echo.
     echo Examples:
     echo   build_rx.bat 1      - Build for GCT Device 1
     echo   build_rx.bat debug  - Build debug version
+    echo   build_rx.bat lowpower 2 - Build low power version for GCT Device 2
     goto end
 )
 
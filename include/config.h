@@ -53,12 +53,33 @@
 #define SD_RETRY_COUNT          5           // SD card mount retry attempts
 #define SD_RETRY_DELAY_MS       1000        // Delay between SD retry attempts
 
+// ===== LOW POWER CONFIGURATION =====
+// Duty-cycled sampling for unattended multi-day runs: the servant deep-sleeps
+// between samples and only powers SD and radio every LP_FLUSH_EVERY_N_WAKES wakes
+#ifndef LOW_POWER_MODE
+    #define LOW_POWER_MODE      0           // 1 = sleep between samples, 0 = stay awake for master requests
+#endif
+#ifndef LP_WAKE_SOURCE_DS3231
+    #define LP_WAKE_SOURCE_DS3231 0         // 1 = wake on DS3231 alarm, 0 = wake on ESP32 RTC timer
+#endif
+#define LP_SAMPLE_INTERVAL_SEC  10          // Time between scheduled samples (2 to inf), slots that fall
+                                            // inside a flush (SD write + up to (N+3) x LP_RADIO_TIMEOUT_MS)
+                                            // are skipped and reported with ACTION_SKIPPED_SLOTS
+#define LP_FLUSH_EVERY_N_WAKES  30          // Samples buffered in RTC memory before SD/radio flush
+#define LP_WAKE_MARGIN_MS       20          // Extra wake lead on top of the measured boot time (timer wake)
+#define LP_RADIO_TIMEOUT_MS     100         // Max wait for each ESP-NOW send confirmation during flush
+#define RTC_INT_PIN             33          // DS3231 SQW/INT pin, must be an RTC GPIO (alarm wake)
+
 // ===== ESP-NOW ACTION IDs =====
 #define ACTION_CONNECTION_TEST  1001
 #define ACTION_START_LOGGING    1002
 #define ACTION_STOP_LOGGING     1003
 #define ACTION_TEMP_REQUEST     3001
 #define ACTION_TEMP_RESPONSE    2001
+#define ACTION_TEMP_BATCH       4001        // Buffered sample flushed in low power mode
+#define ACTION_WAKE_LATENCY_AVG 4002        // Mean wake-to-sample latency of a flushed batch (ms)
+#define ACTION_WAKE_LATENCY_MAX 4003        // Worst wake-to-sample latency of a flushed batch (ms)
+#define ACTION_SKIPPED_SLOTS    4004        // Sample slots skipped since the previous batch
 
 // ===== FILE CONFIGURATION =====
 // Filename will be generated automatically based on GCTID
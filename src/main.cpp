@@ -14,6 +14,7 @@
  * - Robust SD card operations with automatic remount capability
  * - Enhanced communication protocols with master coordination
  * - Local data logging synchronized with master logging state
+ * - Optional duty-cycled low power mode for multi-day deployments (LOW_POWER_MODE)
  */
 
 // System Status - Current Implementation
@@ -45,6 +46,9 @@
 #include <SD.h>
 #include <Adafruit_NeoPixel.h>
 #include <esp_task_wdt.h>
+#include <esp_sleep.h>
+#include <driver/rtc_io.h>
+#include <sys/time.h>
 #include "config.h"
 
 
@@ -91,13 +95,15 @@ uint8_t masterAddress[] = MASTER_MAC_ADDRESS;      // From config.h
 //Do not touch these!!!
 char filename[25] = "";
 #define NUM_SENSORS 9
-char timestamp[19];
+char timestamp[20];
 char line[1000];
 #define numMasters 1
 File file;
 unsigned long sinceLastConnection = 0;
 bool loggingStatus = false;
 bool callbackEnabled = true;
+volatile uint32_t sendCallbacks = 0;    // ESP-NOW delivery callbacks received, they arrive in send order
+volatile bool lastSendOk = false;       // Status reported by the most recent delivery callback
 
 Adafruit_NeoPixel strip(1, LED_PIN, NEO_GRB + NEO_KHZ800);  // Create an instance of the Adafruit_NeoPixel class
 
@@ -190,25 +196,24 @@ void updateStatusLED(int status, int blinkIntervall = 1000){ //MARK: Update stat
 }
 
 
+float validateTemperature(int sensor, float temp) {
+  if (temp == DEVICE_DISCONNECTED_C || temp == -127.00 || temp < TEMP_MIN_VALID || temp > TEMP_MAX_VALID) {
+    Serial.printf("Sensor %d: Invalid reading (%.2f°C)\n", sensor, temp);
+    return TEMP_ERROR_VALUE;
+  }
+  return temp;
+}
+
+
 void get_temperature() {
   sensors.requestTemperatures();
   for (int i = 0; i < NUM_SENSORS; i++) {
-    float temp = sensors.getTempCByIndex(i);
-    
-    // Validate temperature reading
-    if (temp == DEVICE_DISCONNECTED_C || temp == -127.00 || temp < -55.0 || temp > 125.0) {
-      Serial.printf("Sensor %d: Invalid reading (%.2f°C)\n", i, temp);
-      sensorData[i].temperature = -999.0; // Error value
-    } else {
-      sensorData[i].temperature = temp;
-    }
+    sensorData[i].temperature = validateTemperature(i, sensors.getTempCByIndex(i));
   }
 }
 
 
-const char* get_timestamp() {
-    DateTime now = rtc.now();
-    
+const char* format_timestamp(const DateTime& now) {
     // Validate RTC time
     if (now.year() < 2020 || now.year() > 2050) {
         Serial.printf("Warning: Invalid RTC year (%d)\n", now.year());
@@ -220,6 +225,11 @@ const char* get_timestamp() {
     return timestamp;
 }
 
+
+const char* get_timestamp() {
+    return format_timestamp(rtc.now());
+}
+
 void print_temperature() {
     for (int i = 0; i < NUM_SENSORS; i++) {
         Serial.print("Sensor ");
@@ -259,13 +269,13 @@ String tempToString(String timestamp) {//MARK: To String
 }
 
 
-void writeToSD(String dataString) { //MARK: Write to SD
+bool writeToSD(String dataString) { //MARK: Write to SD
     // Check if SD card is still available
     if (!SD.begin(SD_CS_PIN)) {
         Serial.println("SD Card not available for writing");
         callbackEnabled = false;
         updateStatusLED(5);
-        return;
+        return false;
     }
     
     file = SD.open(fileName, FILE_APPEND); // Open the file in append mode
@@ -282,13 +292,13 @@ void writeToSD(String dataString) { //MARK: Write to SD
                 Serial.println("Still failed to open file after remount");
                 callbackEnabled = false;
                 updateStatusLED(5);
-                return;
+                return false;
             }
         } else {
             Serial.println("Failed to remount SD card");
             callbackEnabled = false;
             updateStatusLED(5);
-            return;
+            return false;
         }
     }
 
@@ -298,9 +308,10 @@ void writeToSD(String dataString) { //MARK: Write to SD
     // Verify write was successful
     if (bytesWritten == 0) {
         Serial.println("Warning: No bytes written to SD card");
-    } else {
-        Serial.printf("Successfully wrote %d bytes to SD card\n", bytesWritten);
+        return false;
     }
+    Serial.printf("Successfully wrote %d bytes to SD card\n", bytesWritten);
+    return true;
 }
 
 
@@ -372,6 +383,8 @@ void checkActionID(int actionID){
 
 
 void OnDataSent(const uint8_t *mac_addr, esp_now_send_status_t status) {  //registered callback
+    lastSendOk = status == ESP_NOW_SEND_SUCCESS;
+    sendCallbacks++;
     if(!callbackEnabled){return;} //if the callback is disabled, return
     Serial.print("\r\nLast Packet Send Status:\t");
     Serial.println(status == ESP_NOW_SEND_SUCCESS ? "Delivery Success" : "Delivery Fail");
@@ -388,6 +401,365 @@ void OnDataRecv(const uint8_t *mac_addr, const uint8_t *incomingData, int len) {
 }
 
 
+#if LOW_POWER_MODE //MARK: LOW POWER MODE
+// Duty-cycled sampling: sleep between samples, buffer them in RTC memory and
+// only bring up SD and ESP-NOW every LP_FLUSH_EVERY_N_WAKES wakes.
+static_assert(LP_SAMPLE_INTERVAL_SEC >= 2, "LP_SAMPLE_INTERVAL_SEC must cover a 12-bit conversion");  // Flush overruns are counted at runtime
+static_assert(LP_FLUSH_EVERY_N_WAKES > 0 && LP_FLUSH_EVERY_N_WAKES <= 64, "Sample buffer must fit in RTC memory");
+
+#define LP_STATE_MAGIC 0x47435431       // "GCT1", marks lpState as valid, it holds garbage after power-up
+
+typedef struct lp_sample {
+  uint32_t unixTime;                    // DS3231 time of the sample
+  uint32_t wakeUs;                      // Wake event (timer fire or alarm) to conversion start
+  int32_t slotErrorUs;                  // Conversion start minus the scheduled slot
+  float temperature[NUM_SENSORS];
+} lp_sample;
+
+typedef struct lp_state {
+  uint32_t magic;
+  uint32_t wakeCount;
+  uint8_t romCount;
+  DeviceAddress rom[NUM_SENSORS];       // Sensor ROM map, saves a bus search on every wake
+  int64_t nextSampleUs;                 // Next slot on the ESP32 RTC clock (timer wake)
+  int64_t wakeAtUs;                     // When the timer was set to fire (fallback timer on alarm wake)
+  uint32_t bootLeadUs;                  // Running average of wake-to-ready time (timer wake)
+  uint32_t nextAlarmUnix;               // Next slot on the DS3231 (alarm wake)
+  uint16_t offGridCount;                // Fallback timer wakes since the last flush (alarm wake)
+  uint16_t skippedSlots;                // Grid slots missed since the last flush report
+  uint8_t flushing;                     // Set while a flush runs, a reset mid-flush drops the buffer
+  uint8_t sampleCount;
+  lp_sample samples[LP_FLUSH_EVERY_N_WAKES];
+} lp_state;
+
+// Not reloaded at boot, so it survives deep sleep as well as watchdog, panic and software
+// resets. Power loss and brownout (chip reset) leave it as garbage.
+RTC_NOINIT_ATTR lp_state lpState;
+
+// Batched sample sent on flush, must match the receiver structure
+typedef struct temp_batch {
+  int actionID;
+  uint32_t unixTime;                    // DS3231 time the sample was taken
+  float sens1;
+  float sens2;
+  float sens3;
+  float sens4;
+  float sens5;
+  float sens6;
+  float sens7;
+  float sens8;
+  float sens9;
+} temp_batch;
+temp_batch batchData;
+
+
+int64_t lowPowerClockUs() {
+  // System time is kept by the RTC timer, so it keeps counting through deep sleep
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+}
+
+
+uint32_t lowPowerSaturateUs(int64_t us) {
+  // Missed alarms and long sleeps can exceed 32 bits, saturate instead of wrapping
+  return constrain(us, (int64_t)0, (int64_t)UINT32_MAX);
+}
+
+
+int32_t lowPowerSaturateSignedUs(int64_t us) {
+  return constrain(us, (int64_t)INT32_MIN, (int64_t)INT32_MAX);
+}
+
+
+bool lowPowerWoken() {
+  return lpState.magic == LP_STATE_MAGIC && esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+
+
+String lowPowerSampleToString(const lp_sample& sample) {
+    String data = "";
+    String ts = sample.unixTime ? format_timestamp(DateTime(sample.unixTime)) : "INVALID-TIME";
+    for (int i = 0; i < NUM_SENSORS; i++) {
+        data += ts + "," + String(GCTID) + "," + String(i + 1) + "," + String(sample.temperature[i]) + "\n";
+    }
+    return data;
+}
+
+
+uint32_t lowPowerSendsQueued = 0;       // ESP-NOW sends accepted this wake, matched against sendCallbacks
+
+
+bool lowPowerSend(const uint8_t *data, size_t len) {
+    if (esp_now_send(masterAddress, data, len) != ESP_OK) {
+        return false;
+    }
+    // Callbacks come in send order, so this packet is confirmed once every queued send
+    // has one. A late callback for an earlier packet can then not be credited to this one.
+    uint32_t target = ++lowPowerSendsQueued;
+    unsigned long start = millis();
+    while (sendCallbacks < target && millis() - start < LP_RADIO_TIMEOUT_MS) {
+        delay(1);
+    }
+    return sendCallbacks >= target && lastSendOk;
+}
+
+
+void lowPowerRadioFlush(float avgLatencyMs, float maxLatencyMs) {
+    WiFi.mode(WIFI_STA);
+    esp_wifi_set_channel(1, WIFI_SECOND_CHAN_NONE);
+
+    if (esp_now_init() != ESP_OK) {
+        Serial.println("ESP-NOW Initialization:\tFailed");
+        WiFi.mode(WIFI_OFF);
+        return;
+    }
+    esp_now_register_send_cb(OnDataSent);
+    lowPowerSendsQueued = sendCallbacks;   // Callbacks lost with an earlier deinit must not stall this flush
+
+    memcpy(peerInfo[0].peer_addr, masterAddress, 6);
+    peerInfo[0].channel = 0;
+    peerInfo[0].encrypt = false;
+    if (esp_now_add_peer(&peerInfo[0]) != ESP_OK) {
+        Serial.println("ESP-NOW Peer Addition:\tFailed");
+    } else {
+        int delivered = 0;
+
+        TXdata.actionID = ACTION_WAKE_LATENCY_AVG;
+        TXdata.value = avgLatencyMs;
+        delivered += lowPowerSend((uint8_t *) &TXdata, sizeof(TXdata));
+        TXdata.actionID = ACTION_WAKE_LATENCY_MAX;
+        TXdata.value = maxLatencyMs;
+        delivered += lowPowerSend((uint8_t *) &TXdata, sizeof(TXdata));
+        TXdata.actionID = ACTION_SKIPPED_SLOTS;
+        TXdata.value = lpState.skippedSlots;
+        delivered += lowPowerSend((uint8_t *) &TXdata, sizeof(TXdata));
+
+        for (int s = 0; s < lpState.sampleCount; s++) {
+            esp_task_wdt_reset();
+            const float *t = lpState.samples[s].temperature;
+            batchData.actionID = ACTION_TEMP_BATCH;
+            batchData.unixTime = lpState.samples[s].unixTime;
+            batchData.sens1 = t[0];
+            batchData.sens2 = t[1];
+            batchData.sens3 = t[2];
+            batchData.sens4 = t[3];
+            batchData.sens5 = t[4];
+            batchData.sens6 = t[5];
+            batchData.sens7 = t[6];
+            batchData.sens8 = t[7];
+            batchData.sens9 = t[8];
+            delivered += lowPowerSend((uint8_t *) &batchData, sizeof(batchData));
+        }
+        Serial.printf("Radio flush: %d of %d packets delivered\n", delivered, lpState.sampleCount + 3);
+    }
+
+    esp_now_deinit();
+    WiFi.mode(WIFI_OFF);
+}
+
+
+void lowPowerFlush() { //MARK: Low power flush
+    lpState.flushing = 1;
+    uint64_t sumWakeUs = 0;
+    uint32_t maxWakeUs = 0;
+    int32_t minSlotErrorUs = 0;
+    int32_t maxSlotErrorUs = 0;
+    String data = "";
+    for (int s = 0; s < lpState.sampleCount; s++) {
+        const lp_sample &sample = lpState.samples[s];
+        sumWakeUs += sample.wakeUs;
+        maxWakeUs = max(maxWakeUs, sample.wakeUs);
+        minSlotErrorUs = s ? min(minSlotErrorUs, sample.slotErrorUs) : sample.slotErrorUs;
+        maxSlotErrorUs = s ? max(maxSlotErrorUs, sample.slotErrorUs) : sample.slotErrorUs;
+        data += lowPowerSampleToString(sample);
+    }
+    float avgLatencyMs = lpState.sampleCount ? sumWakeUs / 1000.0 / lpState.sampleCount : 0;
+    float maxLatencyMs = maxWakeUs / 1000.0;
+    Serial.printf("Flushing %d samples, wake-to-sample latency avg %.1f ms, max %.1f ms, %d slots skipped\n",
+                  lpState.sampleCount, avgLatencyMs, maxLatencyMs, lpState.skippedSlots);
+    Serial.printf("Slot error %+.1f to %+.1f ms\n", minSlotErrorUs / 1000.0, maxSlotErrorUs / 1000.0);
+#if LP_WAKE_SOURCE_DS3231
+    if (lpState.offGridCount > 0) {
+        Serial.printf("Warning: %d samples taken off grid after a missed alarm\n", lpState.offGridCount);
+    }
+    lpState.offGridCount = 0;
+#endif
+
+    strip.begin();                      // Not started on a wake, needed for the SD error warning
+    if (!writeToSD(data)) {
+        updateStatusLED(7);             // Fast red blink, ends with the LED off for sleep
+    }
+    SD.end();
+
+    lowPowerRadioFlush(avgLatencyMs, maxLatencyMs);
+
+    // Buffer is dropped even if a sink failed, RTC memory cannot hold a backlog
+    lpState.sampleCount = 0;
+    lpState.skippedSlots = 0;
+    lpState.flushing = 0;
+}
+
+
+void lowPowerSleep() { //MARK: Low power sleep
+    int skipped = 0;
+#if LP_WAKE_SOURCE_DS3231
+    uint32_t nowUnix = rtc.now().unixtime();
+    while (lpState.nextAlarmUnix <= nowUnix + 1) {     // Skip slots missed during a flush
+        lpState.nextAlarmUnix += LP_SAMPLE_INTERVAL_SEC;
+        skipped++;
+    }
+    rtc.clearAlarm(1);
+    rtc.setAlarm1(DateTime(lpState.nextAlarmUnix), DS3231_A1_Date);
+
+    rtc_gpio_pullup_en((gpio_num_t)RTC_INT_PIN);
+    esp_sleep_enable_ext0_wakeup((gpio_num_t)RTC_INT_PIN, 0); // SQW/INT is active low
+    // Fallback timer one interval past the alarm in case the interrupt is missed
+    uint64_t fallbackUs = (uint64_t)(lpState.nextAlarmUnix - nowUnix + LP_SAMPLE_INTERVAL_SEC) * 1000000ULL;
+    lpState.wakeAtUs = lowPowerClockUs() + fallbackUs;
+    esp_sleep_enable_timer_wakeup(fallbackUs);
+    Serial.printf("Sleeping until alarm at %s\n", format_timestamp(DateTime(lpState.nextAlarmUnix)));
+#else
+    int64_t leadUs = lpState.bootLeadUs + LP_WAKE_MARGIN_MS * 1000LL;
+    int64_t nowUs = lowPowerClockUs();
+    while (lpState.nextSampleUs - leadUs <= nowUs) {   // Skip slots missed during a flush
+        lpState.nextSampleUs += LP_SAMPLE_INTERVAL_SEC * 1000000LL;
+        skipped++;
+    }
+    lpState.wakeAtUs = lpState.nextSampleUs - leadUs;
+    esp_sleep_enable_timer_wakeup(lpState.wakeAtUs - nowUs);
+    Serial.printf("Sleeping %.3f s (wake lead %.1f ms)\n", (lpState.wakeAtUs - nowUs) / 1000000.0, leadUs / 1000.0);
+#endif
+
+    if (skipped > 0) {
+        lpState.skippedSlots += skipped;
+        Serial.printf("Warning: skipped %d sample slots, interval shorter than wake + flush time\n", skipped);
+    }
+    Serial.flush();
+    esp_deep_sleep_start();
+}
+
+
+void lowPowerBegin() { //MARK: Low power begin
+    // Called once after the cold-boot self check, stores the sensor ROM map and anchors the schedule
+
+    // A watchdog, panic or software reset boots cold but keeps lpState, so save what was buffered
+    // A reset during a flush drops the buffer instead: part of it may already be on
+    // the SD card, and a flush that faults would otherwise reset again on every boot
+    if (lpState.magic == LP_STATE_MAGIC && lpState.sampleCount > 0) {
+        if (lpState.flushing) {
+            Serial.printf("Discarding %d samples from a flush interrupted by the reset\n", lpState.sampleCount);
+        } else if (lpState.sampleCount <= LP_FLUSH_EVERY_N_WAKES) {
+            Serial.printf("Recovering %d samples buffered before the reset\n", lpState.sampleCount);
+            lowPowerFlush();
+        } else {
+            Serial.printf("Discarding corrupt sample buffer (%d samples)\n", lpState.sampleCount);
+        }
+    }
+
+    lpState.romCount = 0;
+    for (int i = 0; i < NUM_SENSORS; i++) {
+        if (sensors.getAddress(lpState.rom[lpState.romCount], i)) {
+            lpState.romCount++;
+        }
+    }
+    lpState.wakeCount = 0;
+    lpState.sampleCount = 0;
+    lpState.skippedSlots = 0;
+    lpState.flushing = 0;
+    lpState.bootLeadUs = 0;
+    lpState.nextSampleUs = lowPowerClockUs() + LP_SAMPLE_INTERVAL_SEC * 1000000LL;
+
+#if LP_WAKE_SOURCE_DS3231
+    rtc.writeSqwPinMode(DS3231_OFF);    // Route alarms to SQW/INT instead of the square wave
+    rtc.disableAlarm(2);
+    rtc.clearAlarm(1);
+    rtc.clearAlarm(2);
+    lpState.offGridCount = 0;
+    lpState.nextAlarmUnix = rtc.now().unixtime() + LP_SAMPLE_INTERVAL_SEC;
+#endif
+    lpState.magic = LP_STATE_MAGIC;
+
+    Serial.printf("Low power mode:\t\t%d sensors mapped, sample every %d s, flush every %d wakes\n",
+                  lpState.romCount, LP_SAMPLE_INTERVAL_SEC, LP_FLUSH_EVERY_N_WAKES);
+    updateStatusLED(0);
+    lowPowerSleep();
+}
+
+
+void lowPowerWake() { //MARK: Low power wake
+    lpState.wakeCount++;
+    rtc.begin();
+    sensors.setResolution(SENSOR_RESOLUTION);   // Bus is not searched, only sets the conversion wait
+
+#if LP_WAKE_SOURCE_DS3231
+    bool alarmWake = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0;
+    if (!alarmWake) {
+        lpState.offGridCount++;
+        Serial.println("Alarm missed, woken by fallback timer (sample off grid)");
+    }
+    uint32_t slotUnix = lpState.nextAlarmUnix;
+    lpState.nextAlarmUnix += LP_SAMPLE_INTERVAL_SEC;
+#else
+    // Track how long waking takes so the next timer fires early enough, then wait for the slot
+    int64_t readyUs = lowPowerClockUs();
+    uint32_t bootUs = constrain(readyUs - lpState.wakeAtUs, (int64_t)0, (int64_t)LP_SAMPLE_INTERVAL_SEC * 500000);
+    lpState.bootLeadUs = lpState.bootLeadUs ? (lpState.bootLeadUs * 3 + bootUs) / 4 : bootUs;
+
+    int64_t waitUs = lpState.nextSampleUs - readyUs;
+    if (waitUs > 0) {
+        delay(waitUs / 1000);
+        delayMicroseconds(waitUs % 1000);
+    }
+    // The wake cost is timed from the timer firing, the early-wake wait included
+    int64_t slotUs = lpState.nextSampleUs;
+    int64_t wakeEventUs = lpState.wakeAtUs;
+    lpState.nextSampleUs += LP_SAMPLE_INTERVAL_SEC * 1000000LL;
+#endif
+
+    lp_sample &sample = lpState.samples[lpState.sampleCount];
+    sample.unixTime = rtc.now().unixtime();
+    int64_t convStartUs = lowPowerClockUs();
+#if LP_WAKE_SOURCE_DS3231
+    // The DS3231 only reports whole seconds, so catch its next tick while the conversion
+    // runs and place the slot on the RTC-backed clock from it. Clock drift then only
+    // builds up over this one wake. The alarm fires on the slot, so on an alarm wake
+    // the wake cost and the slot error are the same number.
+    unsigned long convStartMs = millis();
+    sensors.setWaitForConversion(false);
+    sensors.requestTemperatures();
+    uint32_t tickUnix = sample.unixTime;
+    while (tickUnix == sample.unixTime && millis() - convStartMs < 1100) {
+        tickUnix = rtc.now().unixtime();
+    }
+    int64_t slotUs = lowPowerClockUs() - ((int64_t)tickUnix - (int64_t)slotUnix) * 1000000LL;
+    int64_t wakeEventUs = alarmWake ? slotUs : lpState.wakeAtUs;
+    unsigned long convMs = sensors.millisToWaitForConversion(SENSOR_RESOLUTION);
+    while (millis() - convStartMs < convMs) {
+        delay(1);
+    }
+#else
+    sensors.requestTemperatures();
+#endif
+    sample.wakeUs = lowPowerSaturateUs(convStartUs - wakeEventUs);
+    sample.slotErrorUs = lowPowerSaturateSignedUs(convStartUs - slotUs);
+    for (int i = 0; i < NUM_SENSORS; i++) {
+        sample.temperature[i] = i < lpState.romCount ? validateTemperature(i, sensors.getTempC(lpState.rom[i])) : TEMP_ERROR_VALUE;
+    }
+    lpState.sampleCount++;
+
+    Serial.printf("Wake #%u: sample %d/%d at %s, wake %.1f ms, slot error %+.1f ms\n", (unsigned)lpState.wakeCount,
+                  lpState.sampleCount, LP_FLUSH_EVERY_N_WAKES, format_timestamp(DateTime(sample.unixTime)),
+                  sample.wakeUs / 1000.0, sample.slotErrorUs / 1000.0);
+
+    if (lpState.sampleCount >= LP_FLUSH_EVERY_N_WAKES) {
+        lowPowerFlush();
+    }
+    lowPowerSleep();
+}
+#endif
+
+
 void setup() { //MARK: SETUP
   // Initialize device ID from build flags
 #ifdef GCT_ID
@@ -396,15 +768,24 @@ void setup() { //MARK: SETUP
   int deviceGCTID = 1; // Default fallback
 #endif
   
-  // Generate filename based on GCTID
-  snprintf(fileName, sizeof(fileName), "GCT_%d.csv", deviceGCTID);
-  
   Serial.begin(115200);   // Start the Serial Monitor
 
   // Initialize watchdog timer (30 seconds timeout)
   esp_task_wdt_init(30, true);
   esp_task_wdt_add(NULL);
 
+  //--------------- FILENAME GENERATION - BEGIN -----------------
+  // Generate filename based on GCTID
+  snprintf(fileName, sizeof(fileName), "/data_GCT%d.csv", GCTID);
+  Serial.printf("Using filename: %s\n", fileName);
+  //--------------- FILENAME GENERATION - END -----------------
+
+#if LOW_POWER_MODE
+  if (lowPowerWoken()) {
+    lowPowerWake(); // Samples and goes back to sleep, does not return
+  }
+#endif
+
   Serial.println("\n\n\nSELF CHECK:\n");
   Serial.print("Device ID: GCT_");
   Serial.println(deviceGCTID);
@@ -488,12 +869,6 @@ void setup() { //MARK: SETUP
   
   //--------------- RTC - INIT - END -----------------
 
-  //--------------- FILENAME GENERATION - BEGIN -----------------
-  // Generate filename based on GCTID
-  snprintf(fileName, sizeof(fileName), "/data_GCT%d.csv", GCTID);
-  Serial.printf("Using filename: %s\n", fileName);
-  //--------------- FILENAME GENERATION - END -----------------
-
   //--------------- SD CARD - INIT - START -----------------
   int sdRetryCount = 0;
   while (!SD.begin(SD_CS_PIN) && sdRetryCount < 5) {
@@ -529,6 +904,10 @@ void setup() { //MARK: SETUP
   }
   //--------------- SD CARD - INIT - END  ------------------
 
+#if LOW_POWER_MODE
+  lowPowerBegin(); // Radio is only brought up for batch flushes, does not return
+#endif
+
   //--------------- ESP NOW - INIT - BEGIN -----------------
     WiFi.mode(WIFI_STA);
     